@@ -0,0 +1,152 @@
+#include "gc_simulator.h"
+#include <malloc.h>
+
+// ------------------------------------------------------
+// Sweep benchmark: builds a large heap (every other object
+// unreachable) and times gc_sweep at increasing thread counts.
+// Every run is checked against threads=1: same survivor order,
+// same GC log and same counters. Allocator usable sizes can differ
+// between runs as malloc reuses memory, so allocator accounting is
+// instead checked against the surviving blocks of each run.
+//
+//   gcc -O2 -pthread bench_sweep.c gc_functions.c -o bench_sweep
+//   ./bench_sweep [objects]
+//
+// The sweep log goes to bench_output.txt (removed at exit) and is
+// hashed for the comparison; timings are printed to stderr.
+// ------------------------------------------------------
+
+#define BENCH_LOG "bench_output.txt"
+
+typedef struct {
+    double seconds;
+    int survivors;
+    unsigned long survivor_hash;
+    unsigned long log_hash;
+    int objects_freed;
+    size_t memory_freed;
+    int allocator_exact;    // allocator_bytes_in_use == usable size of survivors
+} SweepResult;
+
+// FNV-1a, enough to tell two runs apart
+static unsigned long hash_step(unsigned long h, unsigned char byte) {
+    return (h ^ byte) * 1099511628211UL;
+}
+
+static void build_heap(int count) {
+    char name[32];
+
+    for (int i = 0; i < count; i++) {
+        // Bypass create_object: its duplicate-name check is O(n) per call
+        Object *obj = gc_alloc(sizeof(Object));
+        snprintf(name, sizeof(name), "obj%d", i);
+        if (!obj || !(obj->name = gc_alloc(strlen(name) + 1))) {
+            fprintf(stderr, "Memory allocation failed!\n");
+            exit(1);
+        }
+        strcpy(obj->name, name);
+
+        obj->id = i;
+        obj->marked = i % 2;
+        obj->scc_index = -1;
+        obj->refs = NULL;
+        heap_insert(obj);
+
+        total_objects_allocated++;
+        total_memory_allocated += sizeof(Object) + strlen(name) + 1;
+
+        // Link to the previous object of the same colour, as a real mark
+        // phase would leave it: reachable objects only point at reachable ones
+        if (i >= 2)
+            add_reference(obj, heap_head->next->next);
+    }
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static SweepResult run_sweep(int count, int threads) {
+    SweepResult res;
+
+    // add_reference logs every edge; only the sweep log is kept
+    if (!freopen("/dev/null", "w", stdout)) {
+        fprintf(stderr, "Could not redirect stdout.\n");
+        exit(1);
+    }
+    reset_simulator_state();
+    build_heap(count);
+
+    if (!freopen(BENCH_LOG, "w", stdout)) {
+        fprintf(stderr, "Could not redirect stdout to %s.\n", BENCH_LOG);
+        exit(1);
+    }
+
+    gc_sweep_threads = threads;
+    double start = now_seconds();
+    gc_sweep(1);
+    res.seconds = now_seconds() - start;
+    fflush(stdout);
+
+    res.survivors = 0;
+    res.survivor_hash = 14695981039346656037UL;
+    size_t live_usable = 0;
+    for (Object *o = heap_head; o; o = o->next) {
+        res.survivors++;
+        live_usable += malloc_usable_size(o) + malloc_usable_size(o->name);
+        for (RefNode *r = o->refs; r; r = r->next)
+            live_usable += malloc_usable_size(r);
+        for (const char *c = o->name; *c; c++)
+            res.survivor_hash = hash_step(res.survivor_hash, (unsigned char)*c);
+        res.survivor_hash = hash_step(res.survivor_hash, '\n');
+    }
+
+    res.log_hash = 14695981039346656037UL;
+    FILE *log = fopen(BENCH_LOG, "rb");
+    if (!log) {
+        fprintf(stderr, "Could not read back %s.\n", BENCH_LOG);
+        exit(1);
+    }
+    int ch;
+    while ((ch = fgetc(log)) != EOF)
+        res.log_hash = hash_step(res.log_hash, (unsigned char)ch);
+    fclose(log);
+
+    res.objects_freed = total_objects_freed;
+    res.memory_freed = total_memory_freed;
+    res.allocator_exact = live_usable == allocator_bytes_in_use;
+    return res;
+}
+
+int main(int argc, char **argv) {
+    int count = argc > 1 ? atoi(argv[1]) : 2000000;
+    int thread_counts[] = {1, 2, 4, 8};
+    int mismatches = 0;
+    SweepResult base;
+
+    fprintf(stderr, "Sweeping %d objects (%d unreachable)\n", count, count / 2);
+
+    for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); t++) {
+        SweepResult res = run_sweep(count, thread_counts[t]);
+        if (t == 0) base = res;
+
+        int same = res.survivors == base.survivors &&
+                   res.survivor_hash == base.survivor_hash &&
+                   res.log_hash == base.log_hash &&
+                   res.objects_freed == base.objects_freed &&
+                   res.memory_freed == base.memory_freed &&
+                   res.allocator_exact;
+        if (!same) mismatches++;
+
+        fprintf(stderr, "threads=%d  %.3f s  speedup %.2fx  freed %d objects, %zu bytes  %s\n",
+                thread_counts[t], res.seconds, base.seconds / res.seconds,
+                res.objects_freed, res.memory_freed,
+                same ? "matches threads=1" : "MISMATCH vs threads=1");
+    }
+
+    reset_simulator_state();
+    remove(BENCH_LOG);
+    return mismatches ? 1 : 0;
+}
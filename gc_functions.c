@@ -1,5 +1,15 @@
 #include "gc_simulator.h"
 
+#include <malloc.h>
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#define gc_usable_size(p) _msize(p)
+#else
+#include <unistd.h>
+#define gc_usable_size(p) malloc_usable_size(p)
+#endif
+
 // ------------------------------------------------------
 // Global variable definitions
 // ------------------------------------------------------
@@ -10,6 +20,114 @@ int total_objects_allocated = 0;
 int total_objects_freed = 0;
 size_t total_memory_allocated = 0;
 size_t total_memory_freed = 0;
+size_t allocator_bytes_in_use = 0;
+size_t allocator_peak_bytes = 0;
+size_t rss_before_gc = 0;
+size_t rss_after_gc = 0;
+int gc_sweep_threads = 1;         // set by init_sweep_threads at startup
+HeapSegment *heap_segments = NULL;
+int heap_segment_count = 0;
+static int heap_segment_cap = 0;
+
+// ------------------------------------------------------
+// Allocator Accounting
+// ------------------------------------------------------
+void *gc_alloc(size_t size) {
+    void *p = malloc(size);
+    if (!p) return NULL;
+
+    allocator_bytes_in_use += gc_usable_size(p);
+    if (allocator_bytes_in_use > allocator_peak_bytes)
+        allocator_peak_bytes = allocator_bytes_in_use;
+    return p;
+}
+
+// Frees one block and returns its usable size; touches no globals so
+// sweep workers can call it
+static size_t release_block(void *p) {
+    size_t usable = gc_usable_size(p);
+    free(p);
+    return usable;
+}
+
+// Frees a reference list; returns estimated bytes, adds usable bytes
+static size_t release_references(Object *from, size_t *usable) {
+    size_t estimated = 0;
+    RefNode *r = from->refs;
+    while (r) {
+        RefNode *tmp = r;
+        r = r->next;
+        estimated += sizeof(RefNode);
+        *usable += release_block(tmp);
+    }
+    from->refs = NULL;
+    return estimated;
+}
+
+// Frees an object with its name and references; returns estimated bytes
+// (same formula as create_object/add_reference), adds usable bytes
+static size_t release_object(Object *obj, size_t *usable) {
+    size_t estimated = release_references(obj, usable);
+    estimated += sizeof(Object) + strlen(obj->name) + 1;
+    *usable += release_block(obj->name);
+    *usable += release_block(obj);
+    return estimated;
+}
+
+void gc_free(void *p) {
+    if (!p) return;
+    allocator_bytes_in_use -= release_block(p);
+}
+
+// Resident set size of the whole process, 0 if it cannot be read
+size_t read_process_rss(void) {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+        return 0;
+    return (size_t)pmc.WorkingSetSize;
+#else
+    FILE *f = fopen("/proc/self/statm", "r");
+    if (!f) return 0;
+
+    unsigned long size_pages, rss_pages;
+    int ok = fscanf(f, "%lu %lu", &size_pages, &rss_pages) == 2;
+    fclose(f);
+    if (!ok) return 0;
+
+    return (size_t)rss_pages * (size_t)sysconf(_SC_PAGESIZE);
+#endif
+}
+
+// An RSS of 0 means "not measured", never a real reading
+const char *format_rss(char *buf, size_t len, size_t rss) {
+    if (rss == 0)
+        snprintf(buf, len, "n/a");
+    else
+        snprintf(buf, len, "%zu", rss);
+    return buf;
+}
+
+void print_memory_metrics(FILE *out) {
+    size_t estimated = total_memory_allocated - total_memory_freed;
+    char rss[32], before[32], after[32];
+
+    format_rss(rss, sizeof(rss), read_process_rss());
+    format_rss(before, sizeof(before), rss_before_gc);
+    format_rss(after, sizeof(after), rss_after_gc);
+
+    fprintf(out, "%-24s %14s %14s %14s\n", "", "Estimated", "Allocator", "Process RSS");
+    fprintf(out, "%-24s %14zu %14zu %14s\n", "Current in use (bytes)",
+            estimated, allocator_bytes_in_use, rss);
+    fprintf(out, "%-24s %14s %14zu %14s\n", "Peak (bytes)", "-", allocator_peak_bytes, "-");
+    fprintf(out, "RSS before/after last GC: %s -> %s bytes\n", before, after);
+
+    if (estimated > 0)
+        fprintf(out, "Allocator overhead ratio: %.2fx (allocator / estimated)\n",
+                (double)allocator_bytes_in_use / (double)estimated);
+    else
+        fprintf(out, "Allocator overhead ratio: n/a (nothing in use)\n");
+}
 
 // ------------------------------------------------------
 // Utility: Safe Menu Input
@@ -22,14 +140,14 @@ int get_menu_choice() {
             int c;
             while ((c = getchar()) != '\n' && c != EOF) {} // clear buffer
 
-            if (choice < 1 || choice > 9) {
-                printf("Invalid choice! Please enter a number between 1 and 9.\n");
+            if (choice < 1 || choice > 10) {
+                printf("Invalid choice! Please enter a number between 1 and 10.\n");
                 continue;
             }
             return choice;
         }
 
-        printf("Invalid input. Please enter a numeric choice (1–9).\n");
+        printf("Invalid input. Please enter a numeric choice (1–10).\n");
         int ch;
         while ((ch = getchar()) != '\n' && ch != EOF) {}
     }
@@ -44,25 +162,25 @@ Object *create_object(int id, const char *name) {
         return NULL;
     }
 
-    Object *obj = (Object *)malloc(sizeof(Object));
+    Object *obj = (Object *)gc_alloc(sizeof(Object));
     if (!obj) {
         printf("Memory allocation failed!\n");
         exit(1);
     }
 
-    obj->name = malloc(strlen(name) + 1);
+    obj->name = gc_alloc(strlen(name) + 1);
     if (!obj->name) {
         printf("Memory allocation failed for object name.\n");
-        free(obj);
+        gc_free(obj);
         exit(1);
     }
     strcpy(obj->name, name);
 
     obj->id = id;
     obj->marked = 0;
+    obj->scc_index = -1;
     obj->refs = NULL;
-    obj->next = heap_head;
-    heap_head = obj;
+    heap_insert(obj);
 
     total_objects_allocated++;
     total_memory_allocated += sizeof(Object) + strlen(name) + 1;
@@ -96,7 +214,7 @@ void add_reference(Object *from, Object *to) {
         }
     }
 
-    RefNode *node = malloc(sizeof(RefNode));
+    RefNode *node = gc_alloc(sizeof(RefNode));
     if (!node) {
         printf("Memory allocation failed for reference.\n");
         exit(1);
@@ -111,14 +229,40 @@ void add_reference(Object *from, Object *to) {
 }
 
 void clear_references(Object *from) {
-    RefNode *r = from->refs;
-    while (r) {
-        RefNode *tmp = r;
-        r = r->next;
-        total_memory_freed += sizeof(RefNode);
-        free(tmp);
+    size_t usable = 0;
+    total_memory_freed += release_references(from, &usable);
+    allocator_bytes_in_use -= usable;
+}
+
+// ------------------------------------------------------
+// Heap Segments
+// ------------------------------------------------------
+// The heap list is kept as consecutive runs of at most GC_SEGMENT_CAPACITY
+// objects; heap_segments[0] starts at heap_head. Tracking head, tail and
+// count here lets gc_sweep hand segments to workers without walking the list.
+void heap_insert(Object *obj) {
+    if (heap_segment_count == 0 || heap_segments[0].count >= GC_SEGMENT_CAPACITY) {
+        if (heap_segment_count == heap_segment_cap) {
+            int cap = heap_segment_cap ? heap_segment_cap * 2 : 16;
+            HeapSegment *grown = realloc(heap_segments, cap * sizeof(HeapSegment));
+            if (!grown) {
+                printf("Memory allocation failed for heap segments.\n");
+                exit(1);
+            }
+            heap_segments = grown;
+            heap_segment_cap = cap;
+        }
+        memmove(&heap_segments[1], &heap_segments[0], heap_segment_count * sizeof(HeapSegment));
+        heap_segment_count++;
+        heap_segments[0].head = NULL;
+        heap_segments[0].tail = obj;
+        heap_segments[0].count = 0;
     }
-    from->refs = NULL;
+
+    obj->next = heap_head;
+    heap_head = obj;
+    heap_segments[0].head = obj;
+    heap_segments[0].count++;
 }
 
 // ------------------------------------------------------
@@ -136,31 +280,171 @@ void gc_mark_all(Object **roots, int root_count) {
         if (roots[i]) gc_mark(roots[i]);
 }
 
-void gc_sweep() {
-    int collected_count = 0;
-    Object **cur = &heap_head;
+// A contiguous range of heap segments, swept by a single worker.
+// Counters and log lines stay thread-local until the merge in gc_sweep.
+typedef struct {
+    int first, last;        // heap_segments[first..last)
+    int log_objects;
+    int freed_objects;
+    size_t freed_bytes;     // estimated bytes, same formula as create_object
+    size_t freed_usable;    // allocator usable bytes released
+    char *log;
+    size_t log_len;
+    size_t log_cap;
+    int log_failed;         // realloc failed; reported by gc_sweep after the join
+} SweepWorker;
+
+// Runs on worker threads, so an allocation failure is only recorded here
+static void worker_log(SweepWorker *w, const char *name) {
+    if (w->log_failed) return;
+
+    size_t need = strlen("[GC] Collecting unreachable object: \n") + strlen(name) + 1;
+    if (w->log_len + need > w->log_cap) {
+        size_t cap = w->log_cap ? w->log_cap * 2 : 4096;
+        while (cap < w->log_len + need) cap *= 2;
+        char *grown = realloc(w->log, cap);
+        if (!grown) {
+            w->log_failed = 1;
+            return;
+        }
+        w->log = grown;
+        w->log_cap = cap;
+    }
+    w->log_len += sprintf(w->log + w->log_len,
+                          "[GC] Collecting unreachable object: %s\n", name);
+}
 
-    while (*cur) {
-        if (!(*cur)->marked) {
-            Object *unreached = *cur;
-            *cur = unreached->next;
+// Each segment is walked by count, not to NULL: its tail still points into
+// the next segment until gc_sweep relinks the survivors.
+static void *sweep_segments(void *arg) {
+    SweepWorker *w = arg;
+
+    for (int i = w->first; i < w->last; i++) {
+        HeapSegment *seg = &heap_segments[i];
+        Object **cur = &seg->head;
+        Object *tail = NULL;
+        int kept = 0;
+
+        for (int k = seg->count; k > 0; k--) {
+            Object *obj = *cur;
+            if (!obj->marked) {
+                *cur = obj->next;
+                if (w->log_objects) worker_log(w, obj->name);
+                w->freed_objects++;
+                w->freed_bytes += release_object(obj, &w->freed_usable);
+            } else {
+                obj->marked = 0;
+                tail = obj;
+                kept++;
+                cur = &obj->next;
+            }
+        }
 
-            clear_references(unreached);
-            printf("[GC] Collecting unreachable object: %s\n", unreached->name);
+        seg->head = kept ? seg->head : NULL;
+        seg->tail = tail;
+        seg->count = kept;
+    }
+    return NULL;
+}
 
-            total_objects_freed++;
-            collected_count++;
+// log_objects prints one line per collected object, in heap order;
+// callers that have already reported the garbage pass 0
+// GC_SWEEP_THREADS overrides the default of one worker per online CPU;
+// either way the count is clamped to 1..GC_MAX_SWEEP_THREADS
+void init_sweep_threads(void) {
+    long threads = 0;
+    const char *env = getenv("GC_SWEEP_THREADS");
+
+    if (env && *env) {
+        char *end;
+        threads = strtol(env, &end, 10);
+        if (*end != '\0' || threads < 1) {
+            printf("Warning: ignoring invalid GC_SWEEP_THREADS='%s'.\n", env);
+            threads = 0;
+        }
+    }
 
-            total_memory_freed += sizeof(Object) + strlen(unreached->name) + 1;
+    if (threads == 0) {
+#ifdef _WIN32
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        threads = info.dwNumberOfProcessors;
+#else
+        threads = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    }
 
-            free(unreached->name);
-            free(unreached);
-        } else {
-            (*cur)->marked = 0;
-            cur = &((*cur)->next);
+    if (threads < 1) threads = 1;
+    if (threads > GC_MAX_SWEEP_THREADS) threads = GC_MAX_SWEEP_THREADS;
+    gc_sweep_threads = (int)threads;
+}
+
+void gc_sweep(int log_objects) {
+    int nworkers = gc_sweep_threads > 0 ? gc_sweep_threads : 1;
+    if (nworkers > GC_MAX_SWEEP_THREADS) nworkers = GC_MAX_SWEEP_THREADS;
+    if (nworkers > heap_segment_count) nworkers = heap_segment_count;
+    if (nworkers < 1) nworkers = 1;
+
+    SweepWorker workers[GC_MAX_SWEEP_THREADS];
+    memset(workers, 0, sizeof(workers));
+    for (int t = 0; t < nworkers; t++) {
+        workers[t].first = (int)((long)heap_segment_count * t / nworkers);
+        workers[t].last = (int)((long)heap_segment_count * (t + 1) / nworkers);
+        workers[t].log_objects = log_objects;
+    }
+
+    pthread_t threads[GC_MAX_SWEEP_THREADS];
+    int spawned[GC_MAX_SWEEP_THREADS] = {0};
+    for (int t = 1; t < nworkers; t++)
+        spawned[t] = pthread_create(&threads[t], NULL, sweep_segments, &workers[t]) == 0;
+    sweep_segments(&workers[0]);
+    for (int t = 1; t < nworkers; t++) {
+        if (spawned[t]) pthread_join(threads[t], NULL);
+        else sweep_segments(&workers[t]);
+    }
+
+    for (int t = 0; t < nworkers; t++) {
+        if (workers[t].log_failed) {
+            printf("Memory allocation failed for sweep log.\n");
+            exit(1);
         }
     }
 
+    // Relink survivors in original order, merging neighbours that fit in
+    // one segment and dropping empty ones
+    int kept = 0;
+    for (int i = 0; i < heap_segment_count; i++) {
+        HeapSegment seg = heap_segments[i];
+        if (seg.count == 0) continue;
+
+        if (kept > 0) {
+            HeapSegment *prev = &heap_segments[kept - 1];
+            prev->tail->next = seg.head;
+            if (prev->count + seg.count <= GC_SEGMENT_CAPACITY) {
+                prev->tail = seg.tail;
+                prev->count += seg.count;
+                continue;
+            }
+        }
+        heap_segments[kept++] = seg;
+    }
+    heap_segment_count = kept;
+    if (kept > 0) heap_segments[kept - 1].tail->next = NULL;
+    heap_head = kept > 0 ? heap_segments[0].head : NULL;
+
+    // Fold thread-local counters and replay logs in heap order
+    int collected_count = 0;
+    for (int t = 0; t < nworkers; t++) {
+        if (workers[t].log_len)
+            fwrite(workers[t].log, 1, workers[t].log_len, stdout);
+        free(workers[t].log);
+
+        collected_count += workers[t].freed_objects;
+        total_objects_freed += workers[t].freed_objects;
+        total_memory_freed += workers[t].freed_bytes;
+        allocator_bytes_in_use -= workers[t].freed_usable;
+    }
+
     printf("[GC] Cycle complete -> %d object(s) collected.\n", collected_count);
     printf("[GC] Memory freed this cycle: %zu bytes\n", total_memory_freed);
     printf("[GC] Current memory in use: %zu bytes\n\n",
@@ -176,10 +460,271 @@ void run_gc(Object **roots, int root_count) {
     printf("\nRunning garbage collector...\n");
     printf("Before GC: %zu bytes in use\n", total_memory_allocated - total_memory_freed);
 
+    rss_before_gc = read_process_rss();
+
     gc_mark_all(roots, root_count);
-    gc_sweep();
+    report_garbage_islands(stdout);
+    printf("\n");
+    gc_sweep(0);    // per-object lines would repeat the island report
+
+    rss_after_gc = read_process_rss();
+
+    printf("After GC: %zu bytes in use\n", total_memory_allocated - total_memory_freed);
+    printf("Allocator bytes in use: %zu (peak %zu)\n", allocator_bytes_in_use, allocator_peak_bytes);
+    char before[32], after[32];
+    printf("Process RSS: %s -> %s bytes\n\n",
+           format_rss(before, sizeof(before), rss_before_gc),
+           format_rss(after, sizeof(after), rss_after_gc));
+}
 
-    printf("After GC: %zu bytes in use\n\n", total_memory_allocated - total_memory_freed);
+// ------------------------------------------------------
+// Garbage Islands (SCC condensation of unreachable objects)
+// ------------------------------------------------------
+typedef struct {
+    int first;          // offset of this island's members in the bucket array
+    int objects;
+    size_t bytes;       // estimated bytes incl. references, as freed by gc_sweep
+} Island;
+
+static int island_find(int *parent, int x) {
+    while (parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
+    }
+    return x;
+}
+
+static int island_compare(const void *a, const void *b) {
+    const Island *x = a, *y = b;
+    if (x->objects != y->objects) return y->objects - x->objects;
+    if (x->bytes != y->bytes) return y->bytes > x->bytes ? 1 : -1;
+    return x->first - y->first;
+}
+
+static void print_name_list(FILE *out, Object **names, int count) {
+    for (int i = 0; i < count && i < GC_ISLAND_NAME_LIMIT; i++)
+        fprintf(out, "%s%s", i ? ", " : "", names[i]->name);
+    if (count > GC_ISLAND_NAME_LIMIT)
+        fprintf(out, ", ... (+%d more)", count - GC_ISLAND_NAME_LIMIT);
+    fprintf(out, "\n");
+}
+
+// Expects the mark phase to have run. Unreachable objects are grouped
+// into islands (weakly connected components of the garbage subgraph);
+// an iterative Tarjan pass finds the cycles (SCCs with more than one
+// member) and the entry objects (one per SCC nothing else in the
+// garbage points to). Runs in O(objects + references), up to the inverse-Ackermann
+// factor of the union-find (union by size with path halving).
+// Returns the number of unreachable objects.
+int report_garbage_islands(FILE *out) {
+    int n = 0;
+    for (Object *o = heap_head; o; o = o->next)
+        o->scc_index = o->marked ? -1 : n++;
+
+    if (n == 0) {
+        fprintf(out, "No unreachable objects! All nodes are alive.\n");
+        return 0;
+    }
+
+    Object **nodes = malloc(n * sizeof(Object *));
+    Island *islands = malloc(n * sizeof(Island));
+    int *index = malloc(n * sizeof(int));
+    int *low = malloc(n * sizeof(int));
+    int *comp = malloc(n * sizeof(int));
+    int *stack = malloc(n * sizeof(int));
+    char *on_stack = calloc(n, 1);
+    int *call_node = malloc(n * sizeof(int));
+    RefNode **call_edge = malloc(n * sizeof(RefNode *));
+    int *parent = malloc(n * sizeof(int));
+    if (!nodes || !index || !low || !comp || !stack || !on_stack ||
+        !call_node || !call_edge || !parent || !islands) {
+        printf("Memory allocation failed for island report.\n");
+        exit(1);
+    }
+
+    for (Object *o = heap_head; o; o = o->next)
+        if (o->scc_index >= 0) nodes[o->scc_index] = o;
+    for (int i = 0; i < n; i++) {
+        index[i] = -1;
+        parent[i] = i;
+        islands[i].objects = 1;     // union-find set size until islands are built
+    }
+
+    // ---- Tarjan, with an explicit call stack instead of recursion ----
+    int counter = 0, sp = 0, ncomp = 0;
+    for (int s = 0; s < n; s++) {
+        if (index[s] != -1) continue;
+
+        int top = 0;
+        index[s] = low[s] = counter++;
+        stack[sp++] = s;
+        on_stack[s] = 1;
+        call_node[top] = s;
+        call_edge[top++] = nodes[s]->refs;
+
+        while (top > 0) {
+            int v = call_node[top - 1];
+            RefNode *e = call_edge[top - 1];
+            while (e && e->to->scc_index < 0)
+                e = e->next;
+
+            if (e) {
+                call_edge[top - 1] = e->next;
+                int w = e->to->scc_index;
+
+                // Union by size: the smaller set joins the larger one
+                int rv = island_find(parent, v), rw = island_find(parent, w);
+                if (rv != rw) {
+                    if (islands[rv].objects < islands[rw].objects) {
+                        int tmp = rv; rv = rw; rw = tmp;
+                    }
+                    parent[rw] = rv;
+                    islands[rv].objects += islands[rw].objects;
+                }
+
+                if (index[w] == -1) {
+                    index[w] = low[w] = counter++;
+                    stack[sp++] = w;
+                    on_stack[w] = 1;
+                    call_node[top] = w;
+                    call_edge[top++] = nodes[w]->refs;
+                } else if (on_stack[w] && index[w] < low[v]) {
+                    low[v] = index[w];
+                }
+                continue;
+            }
+
+            top--;
+            if (top > 0) {
+                int u = call_node[top - 1];
+                if (low[v] < low[u]) low[u] = low[v];
+            }
+            if (low[v] == index[v]) {
+                int w;
+                do {
+                    w = stack[--sp];
+                    on_stack[w] = 0;
+                    comp[w] = ncomp;
+                } while (w != v);
+                ncomp++;
+            }
+        }
+    }
+
+    // ---- Condense: SCC sizes and in-degrees, island membership ----
+    // index/low are free again; reuse them as SCC size and in-degree
+    int *comp_size = index, *comp_indeg = low;
+    memset(comp_size, 0, ncomp * sizeof(int));
+    memset(comp_indeg, 0, ncomp * sizeof(int));
+    for (int v = 0; v < n; v++) {
+        comp_size[comp[v]]++;
+        for (RefNode *r = nodes[v]->refs; r; r = r->next) {
+            int w = r->to->scc_index;
+            if (w >= 0 && comp[w] != comp[v]) comp_indeg[comp[w]]++;
+        }
+    }
+
+    // Bucket members by island (heap order kept within each island)
+    int *island_of = stack, nisland = 0;
+    for (int v = 0; v < n; v++) island_of[v] = -1;
+    Object **names = malloc(n * sizeof(Object *));
+    int *members = call_node;
+    if (!names) {
+        printf("Memory allocation failed for island report.\n");
+        exit(1);
+    }
+    for (int v = 0; v < n; v++) {
+        int root = island_find(parent, v);
+        if (island_of[root] == -1) {
+            islands[nisland].objects = 0;
+            islands[nisland].bytes = 0;
+            island_of[root] = nisland++;
+        }
+        Island *isl = &islands[island_of[root]];
+        isl->objects++;
+        isl->bytes += sizeof(Object) + strlen(nodes[v]->name) + 1;
+        for (RefNode *r = nodes[v]->refs; r; r = r->next)
+            isl->bytes += sizeof(RefNode);
+    }
+    for (int i = 0, off = 0; i < nisland; i++) {
+        islands[i].first = off;
+        off += islands[i].objects;
+        islands[i].objects = 0;
+    }
+    for (int v = 0; v < n; v++) {
+        Island *isl = &islands[island_of[island_find(parent, v)]];
+        members[isl->first + isl->objects++] = v;
+    }
+
+    qsort(islands, nisland, sizeof(Island), island_compare);
+
+    // ---- Report, largest island first ----
+    char *comp_done = on_stack;     // all zero again after Tarjan; bit 1 entry, bit 2 cycle
+    size_t total_bytes = 0;
+    int shown = nisland < GC_ISLAND_REPORT_LIMIT ? nisland : GC_ISLAND_REPORT_LIMIT;
+
+    fprintf(out, "Garbage islands (largest first):\n");
+    for (int i = 0; i < nisland; i++) {
+        Island *isl = &islands[i];
+        int *m = &members[isl->first];
+        total_bytes += isl->bytes;
+        if (i >= shown) continue;
+
+        int nentry = 0, ncycle = 0, cyclic_objects = 0;
+        fprintf(out, "Island %d: %d object(s), %zu bytes\n", i + 1, isl->objects, isl->bytes);
+
+        // One entry per source SCC, named by its first member in heap order
+        fprintf(out, "   Entry objects: ");
+        for (int k = 0; k < isl->objects; k++) {
+            int c = comp[m[k]];
+            if (comp_size[c] > 1) cyclic_objects++;
+            if (comp_indeg[c] != 0 || (comp_done[c] & 1)) continue;
+            comp_done[c] |= 1;
+
+            if (nentry++ >= GC_ISLAND_NAME_LIMIT) continue;
+            fprintf(out, "%s%s", nentry > 1 ? ", " : "", nodes[m[k]]->name);
+            if (comp_size[c] > 1)
+                fprintf(out, " (cycle of %d)", comp_size[c]);
+        }
+        if (nentry > GC_ISLAND_NAME_LIMIT)
+            fprintf(out, ", ... (+%d more)", nentry - GC_ISLAND_NAME_LIMIT);
+        fprintf(out, "\n");
+
+        for (int k = 0; k < isl->objects; k++) {
+            int c = comp[m[k]];
+            if (comp_size[c] < 2 || (comp_done[c] & 2)) continue;
+            comp_done[c] |= 2;
+
+            // Only the first few cycles are listed, which keeps this scan linear
+            if (++ncycle > GC_ISLAND_NAME_LIMIT) continue;
+            int len = 0;
+            for (int j = k; j < isl->objects; j++)
+                if (comp[m[j]] == c) names[len++] = nodes[m[j]];
+            fprintf(out, "   Cycle (%d objects): ", len);
+            print_name_list(out, names, len);
+        }
+        if (ncycle == 0)
+            fprintf(out, "   Cycles: none (acyclic)\n");
+        else
+            fprintf(out, "   %d cycle(s), %d of %d object(s) on a cycle\n",
+                    ncycle, cyclic_objects, isl->objects);
+    }
+    if (nisland > shown)
+        fprintf(out, "... %d more island(s) not shown\n", nisland - shown);
+    fprintf(out, "Total: %d island(s), %d object(s), %zu bytes\n", nisland, n, total_bytes);
+
+    free(islands);
+    free(names);
+    free(nodes);
+    free(index);
+    free(low);
+    free(comp);
+    free(stack);
+    free(on_stack);
+    free(call_node);
+    free(call_edge);
+    free(parent);
+    return n;
 }
 
 // ------------------------------------------------------
@@ -229,6 +774,13 @@ void write_dot(const char *filename, Object **roots, int root_count) {
 // Final Cleanup
 // ------------------------------------------------------
 void final_cleanup() {
+    // The cleanup walk below follows heap_head, so the segment
+    // bookkeeping can go first (also when the heap is already empty)
+    free(heap_segments);
+    heap_segments = NULL;
+    heap_segment_count = 0;
+    heap_segment_cap = 0;
+
     if (!heap_head) {
         printf("\n[Cleanup] No remaining objects to free.\n");
         return;
@@ -246,8 +798,8 @@ void final_cleanup() {
         total_objects_freed++;
         total_memory_freed += sizeof(Object) + strlen(cur->name) + 1;
 
-        free(cur->name);
-        free(cur);
+        gc_free(cur->name);
+        gc_free(cur);
 
         cur = next;
     }
@@ -267,8 +819,6 @@ void force_leak_scenario(int scenario_id) {
     printf("\n[Force Leak] Creating scenario %d...\n", scenario_id);
 
     int scenario_id_counter = 1000;
-    Object *scenario_created[128];
-    int scenario_obj_count = 0;
 
     // ------------------------- SCENARIO 1 -------------------------
     if (scenario_id == 1) {
@@ -278,12 +828,6 @@ void force_leak_scenario(int scenario_id) {
         Object *D = create_object(scenario_id_counter++, "D");
         Object *E = create_object(scenario_id_counter++, "E");
 
-        scenario_created[scenario_obj_count++] = A;
-        scenario_created[scenario_obj_count++] = B;
-        scenario_created[scenario_obj_count++] = C;
-        scenario_created[scenario_obj_count++] = D;
-        scenario_created[scenario_obj_count++] = E;
-
         add_reference(A, B);
         add_reference(B, C);
         add_reference(D, E);
@@ -299,10 +843,6 @@ void force_leak_scenario(int scenario_id) {
         Object *B = create_object(scenario_id_counter++, "B");
         Object *C = create_object(scenario_id_counter++, "C");
 
-        scenario_created[scenario_obj_count++] = A;
-        scenario_created[scenario_obj_count++] = B;
-        scenario_created[scenario_obj_count++] = C;
-
         add_reference(A, B);
         add_reference(B, C);
         add_reference(C, A);
@@ -310,9 +850,6 @@ void force_leak_scenario(int scenario_id) {
         Object *D = create_object(scenario_id_counter++, "D");
         Object *E = create_object(scenario_id_counter++, "E");
 
-        scenario_created[scenario_obj_count++] = D;
-        scenario_created[scenario_obj_count++] = E;
-
         add_reference(D, E);
         add_reference(E, D);
 
@@ -330,8 +867,6 @@ void force_leak_scenario(int scenario_id) {
             snprintf(name, sizeof(name), "N%d", i);
             Object *node = create_object(scenario_id_counter++, name);
 
-            scenario_created[scenario_obj_count++] = node;
-
             if (prev) add_reference(prev, node);
             else roots[root_count++] = node;
 
@@ -340,8 +875,7 @@ void force_leak_scenario(int scenario_id) {
 
         for (int i = 1; i <= 5; ++i) {
             snprintf(name, sizeof(name), "X%d", i);
-            Object *x = create_object(scenario_id_counter++, name);
-            scenario_created[scenario_obj_count++] = x;
+            create_object(scenario_id_counter++, name);
         }
 
         printf("[Force Leak] Scenario 3 created.\n");
@@ -358,37 +892,17 @@ void force_leak_scenario(int scenario_id) {
     gc_mark_all(roots, root_count);
 
     // -------------------------------------------------------------------
-    // REPORT UNREACHABLE OBJECTS
+    // REPORT UNREACHABLE OBJECTS (grouped into cyclic islands)
     // -------------------------------------------------------------------
     printf("\n--- Unreachable Objects (Garbage) ---\n");
-    int unreachable_count = 0;
-    size_t garbage_bytes_est = 0;
-
-    for (int i = 0; i < scenario_obj_count; ++i) {
-        Object *o = scenario_created[i];
-
-        if (o && !o->marked) {
-            printf(" - %s\n", o->name);
-            unreachable_count++;
-
-            garbage_bytes_est += sizeof(Object) + strlen(o->name) + 1;
-        }
-    }
-
-    if (unreachable_count == 0) {
-        printf("No unreachable objects! All nodes are alive.\n");
-    } else {
-        printf("\nTotal unreachable = %d object(s)\n", unreachable_count);
-        printf("Garbage memory (will be freed now) = %zu bytes\n", garbage_bytes_est);
-    }
-
+    int unreachable_count = report_garbage_islands(stdout);
     printf("-------------------------------------\n");
 
     // -------------------------------------------------------------------
     // SWEEP PHASE — free garbage
     // -------------------------------------------------------------------
     if (unreachable_count > 0)
-        gc_sweep();
+        gc_sweep(0);    // the island report above already names the garbage
     else {
         Object *cur = heap_head;
         while (cur) {
@@ -426,13 +940,14 @@ void reset_simulator_state() {
         Object *next = cur->next;
 
         clear_references(cur);
-        free(cur->name);
-        free(cur);
+        gc_free(cur->name);
+        gc_free(cur);
 
         cur = next;
     }
 
     heap_head = NULL;
+    heap_segment_count = 0;
 
     for (int i = 0; i < root_count; i++)
         roots[i] = NULL;
@@ -443,6 +958,7 @@ void reset_simulator_state() {
     total_objects_freed = 0;
     total_memory_allocated = 0;
     total_memory_freed = 0;
+    allocator_peak_bytes = allocator_bytes_in_use;
 }
 
 // ------------------------------------------------------
@@ -472,6 +988,10 @@ void export_snapshot(void) {
     fprintf(f, "Current memory in use:  %zu bytes\n\n",
             total_memory_allocated - total_memory_freed);
 
+    fprintf(f, "=== Memory Metrics ===\n");
+    print_memory_metrics(f);
+    fprintf(f, "\n");
+
     fprintf(f, "=== Objects in Heap ===\n");
 
     Object *cur = heap_head;
@@ -497,3 +1017,32 @@ void export_snapshot(void) {
 
     printf("Snapshot exported successfully: %s\n", filename);
 }
+
+// ------------------------------------------------------
+// Dump Memory Metrics (.txt)
+// ------------------------------------------------------
+void dump_memory_metrics(void) {
+    static int metrics_counter = 1;
+    char filename[64];
+
+    sprintf(filename, "metrics_%d.txt", metrics_counter++);
+
+    FILE *f = fopen(filename, "w");
+    if (!f) {
+        printf("Error: Could not create metrics file.\n");
+        return;
+    }
+
+    fprintf(f, "===== MEMORY METRICS =====\n");
+
+    time_t now = time(NULL);
+    fprintf(f, "Timestamp: %s\n", ctime(&now));
+
+    fprintf(f, "Live objects: %d\n", total_objects_allocated - total_objects_freed);
+    print_memory_metrics(f);
+
+    fprintf(f, "======= END OF METRICS =======\n");
+    fclose(f);
+
+    printf("Metrics dumped successfully: %s\n", filename);
+}
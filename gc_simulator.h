@@ -4,6 +4,12 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
+
+#define GC_MAX_SWEEP_THREADS 16
+#define GC_SEGMENT_CAPACITY 4096      // max objects per heap segment
+#define GC_ISLAND_REPORT_LIMIT 10     // islands listed in full by report_garbage_islands
+#define GC_ISLAND_NAME_LIMIT 8        // names listed per entry/cycle line
 
 // ------------------------------------------------------
 // Data Structures
@@ -17,10 +23,17 @@ struct RefNode {
     RefNode *next;
 };
 
+typedef struct {
+    Object *head;
+    Object *tail;
+    int count;
+} HeapSegment;
+
 struct Object {
     int id;
     char *name;     // dynamically allocated string (must be freed)
     int marked;
+    int scc_index;  // scratch slot for report_garbage_islands
     RefNode *refs;
     Object *next;
 };
@@ -36,6 +49,13 @@ extern int total_objects_allocated;
 extern int total_objects_freed;
 extern size_t total_memory_allocated;
 extern size_t total_memory_freed;
+extern size_t allocator_bytes_in_use;   // malloc usable size of live simulator blocks
+extern size_t allocator_peak_bytes;
+extern size_t rss_before_gc;            // process RSS sampled around the last run_gc
+extern size_t rss_after_gc;
+extern int gc_sweep_threads;            // worker threads used by gc_sweep
+extern HeapSegment *heap_segments;      // heap list split into runs, front first
+extern int heap_segment_count;
 void force_leak_scenario(int scenario_id);
 
 
@@ -46,16 +66,25 @@ void force_leak_scenario(int scenario_id);
 int get_menu_choice(void);
 Object *create_object(int id, const char *name);
 Object *find_object_by_name(const char *name);
+void heap_insert(Object *obj);
 void add_reference(Object *from, Object *to);
 void clear_references(Object *from);
 void gc_mark(Object *root);
 void gc_mark_all(Object **roots, int root_count);
-void gc_sweep(void);
+void init_sweep_threads(void);
+void gc_sweep(int log_objects);
 void run_gc(Object **roots, int root_count);
+int report_garbage_islands(FILE *out);
 void write_dot(const char *filename, Object **roots, int root_count);
 void final_cleanup(void);
 void reset_simulator_state();
 void export_snapshot(void);
+void *gc_alloc(size_t size);
+void gc_free(void *p);
+size_t read_process_rss(void);
+const char *format_rss(char *buf, size_t len, size_t rss);
+void print_memory_metrics(FILE *out);
+void dump_memory_metrics(void);
 
 
 
@@ -5,6 +5,8 @@ int main() {
     char name1[100], name2[100]; // use temporary local buffers for user input
     int c; // for clearing buffer
 
+    init_sweep_threads(); // honours GC_SWEEP_THREADS, else one per CPU
+
     while (1) {
         printf("\n===== MEMORY LEAK VISUAL DEMO =====\n");
         printf("1. Create Object\n");
@@ -16,6 +18,7 @@ int main() {
         printf("7. Exit\n");
         printf("8. Force Leak Scenario\n");
         printf("9. Export Snapshot\n");
+        printf("10. Dump Memory Metrics\n");
 
         // Input safely (handles non-numeric & out-of-range)
         choice = get_menu_choice();
@@ -112,8 +115,9 @@ int main() {
                 printf("Total objects freed:   %d\n", total_objects_freed);
                 printf("Total memory allocated: %zu bytes\n", total_memory_allocated);
                 printf("Total memory freed:     %zu bytes\n", total_memory_freed);
-                printf("Current memory in use:  %zu bytes\n",
+                printf("Current memory in use:  %zu bytes\n\n",
                        total_memory_allocated - total_memory_freed);
+                print_memory_metrics(stdout);
                 break;
 
             // ------------------------------------------------------
@@ -145,6 +149,10 @@ int main() {
                 export_snapshot();
                 break;
 
+            case 10:
+                dump_memory_metrics();
+                break;
+
             // ------------------------------------------------------
             // Invalid Option (fallback)
             // ------------------------------------------------------